@@ -10,6 +10,31 @@
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 64
 #define OLED_RESET -1
+#define OLED_ADDRESS 0x3C
+
+// I2C bus speeds. SSD1306 is specified for 400kHz fast-mode, but most
+// panels run reliably at 1MHz fast-mode plus with short wiring.
+#define MINTUI_I2C_STANDARD 100000UL
+#define MINTUI_I2C_FAST 400000UL
+#define MINTUI_I2C_FAST_PLUS 1000000UL
+
+// Largest single Wire transaction (control byte + payload). Mirrors the
+// buffer size each core's Wire implementation exposes.
+#ifndef MINTUI_WIRE_MAX
+  #if defined(I2C_BUFFER_LENGTH)
+    #define MINTUI_WIRE_MAX (I2C_BUFFER_LENGTH < 256 ? I2C_BUFFER_LENGTH : 256)
+  #elif defined(BUFFER_LENGTH)
+    #define MINTUI_WIRE_MAX (BUFFER_LENGTH < 256 ? BUFFER_LENGTH : 256)
+  #else
+    #define MINTUI_WIRE_MAX 32
+  #endif
+#endif
+
+// Send only the changed part of each frame. Costs a 1KB copy of the last
+// frame; define as 0 on small-RAM boards to always send full frames.
+#ifndef MINTUI_PARTIAL_FLUSH
+  #define MINTUI_PARTIAL_FLUSH 1
+#endif
 
 // -------------------------------------------------------------------------
 // Easing Curve
@@ -481,6 +506,319 @@ public:
     String getTitle() const { return title; }
 };
 
+// -------------------------------------------------------------------------
+// Display Transport
+// -------------------------------------------------------------------------
+
+// Moves command and data bytes to the panel. Consecutive writes of the same
+// kind are packed into as few bus transactions as the transfer limit allows,
+// so the control byte and addressing are only paid once per transaction.
+class DisplayTransport {
+public:
+    static const uint8_t CONTROL_COMMAND = 0x00;
+    static const uint8_t CONTROL_DATA = 0x40;
+
+private:
+    bool (*acquireHook)();
+    void (*releaseHook)();
+    size_t maxTransfer;
+    bool open;
+    uint8_t openControl;
+    size_t openCount;
+    bool failed; // A transaction since the last releaseBus() was not acknowledged
+
+    void write(uint8_t control, const uint8_t* bytes, size_t len) {
+        while (len > 0) {
+            if (open && (control != openControl || openCount >= maxTransfer)) {
+                flushPending();
+            }
+            if (!open) {
+                startTransaction(control);
+                open = true;
+                openControl = control;
+                openCount = 1; // Control byte
+            }
+
+            size_t room = maxTransfer - openCount;
+            size_t n = len < room ? len : room;
+            writeBytes(bytes, n);
+            openCount += n;
+            bytes += n;
+            len -= n;
+        }
+    }
+
+protected:
+    // One bus transaction: start, any number of writeBytes(), end.
+    // endTransaction() returns false if the panel did not acknowledge.
+    virtual void startTransaction(uint8_t control) = 0;
+    virtual void writeBytes(const uint8_t* bytes, size_t len) = 0;
+    virtual bool endTransaction() = 0;
+
+    // Called after the arbiter hands the bus to us / before we hand it back
+    virtual void busAcquired() {}
+    virtual void busReleased() {}
+
+public:
+    DisplayTransport(size_t maxTransfer = MINTUI_WIRE_MAX)
+        : acquireHook(nullptr), releaseHook(nullptr),
+          maxTransfer(maxTransfer < 2 ? 2 : maxTransfer),
+          open(false), openControl(0), openCount(0), failed(false) {}
+
+    virtual ~DisplayTransport() {}
+
+    virtual bool begin() { return true; }
+    virtual void setClock(uint32_t /*hz*/) {}
+
+    // Cooperative bus sharing with other I2C devices. acquire() returns
+    // false while someone else owns the bus; the frame is then skipped and
+    // retried on the next update.
+    void setBusArbiter(bool (*acquire)(), void (*release)()) {
+        acquireHook = acquire;
+        releaseHook = release;
+    }
+
+    bool acquireBus() {
+        if (acquireHook && !acquireHook()) return false;
+        busAcquired();
+        return true;
+    }
+
+    // Returns false if any transaction since acquireBus() failed
+    bool releaseBus() {
+        flushPending();
+        busReleased();
+        if (releaseHook) releaseHook();
+        
+        bool ok = !failed;
+        failed = false;
+        return ok;
+    }
+
+    void writeCommands(const uint8_t* cmds, size_t len) {
+        write(CONTROL_COMMAND, cmds, len);
+    }
+
+    void writeData(const uint8_t* data, size_t len) {
+        write(CONTROL_DATA, data, len);
+    }
+
+    // Restrict following data writes to columns col0..col1, pages page0..page1
+    // (requires horizontal addressing mode, which Adafruit_SSD1306 sets up)
+    void setWindow(uint8_t col0, uint8_t col1, uint8_t page0, uint8_t page1) {
+        const uint8_t cmds[] = {
+            SSD1306_COLUMNADDR, col0, col1,
+            SSD1306_PAGEADDR, page0, page1
+        };
+        writeCommands(cmds, sizeof(cmds));
+    }
+
+    void flushPending() {
+        if (open) {
+            if (!endTransaction()) failed = true;
+            open = false;
+        }
+    }
+
+    size_t getMaxTransfer() const { return maxTransfer; }
+};
+
+// -------------------------------------------------------------------------
+// Wire Transport
+// -------------------------------------------------------------------------
+
+class WireTransport : public DisplayTransport {
+private:
+    TwoWire* wire;
+    uint8_t address;
+    uint32_t clock;
+    uint32_t restoreClock;
+
+protected:
+    void startTransaction(uint8_t control) override {
+        wire->beginTransmission(address);
+        wire->write(control);
+    }
+
+    void writeBytes(const uint8_t* bytes, size_t len) override {
+        wire->write(bytes, len);
+    }
+
+    bool endTransaction() override {
+        return wire->endTransmission() == 0;
+    }
+
+    void busAcquired() override {
+        wire->setClock(clock);
+    }
+
+    void busReleased() override {
+        // Like Adafruit's clkAfter: drop back so slower devices keep working
+        if (restoreClock) wire->setClock(restoreClock);
+    }
+
+public:
+    WireTransport(TwoWire* wire = &Wire, uint8_t address = OLED_ADDRESS,
+                  uint32_t clockHz = MINTUI_I2C_FAST,
+                  uint32_t restoreHz = MINTUI_I2C_STANDARD)
+        : wire(wire), address(address), clock(clockHz),
+          restoreClock(restoreHz) {}
+
+    // Clock used while a frame is sent
+    void setClock(uint32_t hz) override { clock = hz; }
+    uint32_t getClock() const { return clock; }
+
+    // Clock left on the bus between frames; 0 keeps the frame clock
+    // (fine when the display is alone on the bus)
+    void setRestoreClock(uint32_t hz) { restoreClock = hz; }
+    uint32_t getRestoreClock() const { return restoreClock; }
+
+    void setAddress(uint8_t addr) { address = addr; }
+    uint8_t getAddress() const { return address; }
+};
+
+// -------------------------------------------------------------------------
+// Recording Transport
+// -------------------------------------------------------------------------
+
+// Loopback transport for host builds and benchmarks. Counts transactions
+// and bytes exactly as WireTransport would put them on the bus, and keeps
+// a copy of the panel RAM so flushed frames can be checked.
+class RecordingTransport : public DisplayTransport {
+private:
+    static const int PAGES = SCREEN_HEIGHT / 8;
+
+    unsigned long transactions;
+    unsigned long busBytes;
+    unsigned long commandBytes;
+    unsigned long dataBytes;
+    unsigned long failuresLeft;
+    uint8_t control;
+
+    uint8_t ram[SCREEN_WIDTH * PAGES];
+    uint8_t colStart, colEnd, pageStart, pageEnd;
+    uint8_t col, page;
+
+    uint8_t command;
+    int argIndex;
+    int argCount; // Arguments still expected for command
+
+    // Argument bytes following each SSD1306 opcode
+    static int commandArgs(uint8_t op) {
+        switch (op) {
+            case SSD1306_COLUMNADDR:
+            case SSD1306_PAGEADDR:
+            case 0xA3: // Vertical scroll area
+                return 2;
+            case 0x26: // Horizontal scroll
+            case 0x27:
+                return 6;
+            case 0x29: // Vertical + horizontal scroll
+            case 0x2A:
+                return 5;
+            case 0x20: // Memory mode
+            case 0x81: // Contrast
+            case 0x8D: // Charge pump
+            case 0xA8: // Multiplex
+            case 0xD3: // Display offset
+            case 0xD5: // Clock divide
+            case 0xD9: // Precharge
+            case 0xDA: // COM pins
+            case 0xDB: // VCOM detect
+                return 1;
+            default:
+                return 0;
+        }
+    }
+
+    // Only the window commands change the simulated RAM; other commands
+    // are parsed just far enough to skip their arguments
+    void handleCommand(uint8_t b) {
+        if (argCount == 0) {
+            command = b;
+            argIndex = 0;
+            argCount = commandArgs(b);
+            return;
+        }
+
+        if (command == SSD1306_COLUMNADDR) {
+            if (argIndex == 0) colStart = b;
+            else { colEnd = b; col = colStart; }
+        } else if (command == SSD1306_PAGEADDR) {
+            if (argIndex == 0) pageStart = b;
+            else { pageEnd = b; page = pageStart; }
+        }
+        argIndex++;
+        argCount--;
+    }
+
+    void handleData(uint8_t b) {
+        if (col < SCREEN_WIDTH && page < PAGES) {
+            ram[page * SCREEN_WIDTH + col] = b;
+        }
+        if (col >= colEnd) {
+            col = colStart;
+            page = (page >= pageEnd) ? pageStart : page + 1;
+        } else {
+            col++;
+        }
+    }
+
+protected:
+    void startTransaction(uint8_t ctrl) override {
+        control = ctrl;
+        transactions++;
+        busBytes += 2; // Address + control byte
+    }
+
+    void writeBytes(const uint8_t* bytes, size_t len) override {
+        busBytes += len;
+        for (size_t i = 0; i < len; i++) {
+            if (control == CONTROL_COMMAND) {
+                commandBytes++;
+                handleCommand(bytes[i]);
+            } else {
+                dataBytes++;
+                handleData(bytes[i]);
+            }
+        }
+    }
+
+    bool endTransaction() override {
+        if (failuresLeft == 0) return true;
+        failuresLeft--;
+        return false;
+    }
+
+public:
+    RecordingTransport(size_t maxTransfer = MINTUI_WIRE_MAX)
+        : DisplayTransport(maxTransfer),
+          transactions(0), busBytes(0), commandBytes(0), dataBytes(0),
+          failuresLeft(0), control(CONTROL_COMMAND),
+          colStart(0), colEnd(SCREEN_WIDTH - 1), pageStart(0), pageEnd(PAGES - 1),
+          col(0), page(0), command(0), argIndex(0), argCount(0) {
+        memset(ram, 0, sizeof(ram));
+    }
+
+    // Clears the counters; panel RAM and addressing state are kept
+    void reset() {
+        transactions = 0;
+        busBytes = 0;
+        commandBytes = 0;
+        dataBytes = 0;
+    }
+    
+    // Report the next count transactions as not acknowledged (the data is
+    // still written to the simulated RAM)
+    void injectFailures(unsigned long count) { failuresLeft = count; }
+
+    unsigned long getTransactions() const { return transactions; }
+    unsigned long getBusBytes() const { return busBytes; }
+    unsigned long getCommandBytes() const { return commandBytes; }
+    unsigned long getDataBytes() const { return dataBytes; }
+    const uint8_t* getRam() const { return ram; }
+};
+
 // -------------------------------------------------------------------------
 // UI Engine
 // -------------------------------------------------------------------------
@@ -493,6 +831,16 @@ private:
     int maxStackSize;
     bool popping; // State to track if we are currently popping a window
     
+    // Display transport
+    WireTransport wireTransport;
+    DisplayTransport* transport;
+    bool (*busAcquire)();
+    void (*busRelease)();
+    #if MINTUI_PARTIAL_FLUSH
+    uint8_t shadow[SCREEN_WIDTH * (SCREEN_HEIGHT / 8)]; // Last frame sent to the panel
+    #endif
+    bool shadowValid;
+    
     // Button pins
     int btnUp, btnDown, btnSelect, btnBack;
     
@@ -508,6 +856,9 @@ public:
              int btnSelect = 27, int btnBack = 26)
         : display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET),
           stackSize(0), maxStackSize(5), popping(false),
+          wireTransport(&Wire, OLED_ADDRESS), transport(&wireTransport),
+          busAcquire(nullptr), busRelease(nullptr),
+          shadowValid(false),
           btnUp(btnUp), btnDown(btnDown), 
           btnSelect(btnSelect), btnBack(btnBack) {
         
@@ -542,7 +893,11 @@ public:
         Wire.begin();
         
         // Address 0x3C for 128x64
-        if (!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) {
+        if (!display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDRESS)) {
+            return false;
+        }
+        
+        if (!transport->begin()) {
             return false;
         }
         
@@ -552,7 +907,99 @@ public:
         }
         
         display.clearDisplay();
-        display.display();
+        invalidate();
+        flush();
+        return true;
+    }
+    
+    // Route frames through a different transport (e.g. RecordingTransport),
+    // or back to the built-in Wire transport with nullptr. The bus arbiter
+    // moves along with it. Ownership stays with the caller.
+    void setTransport(DisplayTransport* t) {
+        transport = t ? t : &wireTransport;
+        transport->setBusArbiter(busAcquire, busRelease);
+        invalidate();
+    }
+    
+    DisplayTransport* getTransport() {
+        return transport;
+    }
+    
+    // I2C clock for the built-in Wire transport (not custom ones) while a frame is sent
+    // (MINTUI_I2C_FAST by default) and between frames (MINTUI_I2C_STANDARD)
+    void setBusClock(uint32_t hz, uint32_t restoreHz = MINTUI_I2C_STANDARD) {
+        wireTransport.setClock(hz);
+        wireTransport.setRestoreClock(restoreHz);
+    }
+    
+    // Applies to the current transport and any set later
+    void setBusArbiter(bool (*acquire)(), void (*release)()) {
+        busAcquire = acquire;
+        busRelease = release;
+        transport->setBusArbiter(acquire, release);
+    }
+    
+    // Force the next flush to resend the whole frame, e.g. after drawing
+    // with getDisplay().display() or reinitializing the panel
+    void invalidate() {
+        shadowValid = false;
+    }
+    
+    // Send the parts of the frame buffer that changed since the last flush.
+    // Returns false if the bus arbiter kept the bus or a write failed;
+    // nothing is lost, the changes go out with the next flush.
+    bool flush() {
+        const int pages = SCREEN_HEIGHT / 8;
+        const uint8_t* buffer = display.getBuffer();
+        
+        #if MINTUI_PARTIAL_FLUSH
+        // Bounding window of changed bytes
+        int col0 = SCREEN_WIDTH, col1 = -1;
+        int page0 = pages, page1 = -1;
+        for (int p = 0; p < pages; p++) {
+            const uint8_t* row = buffer + p * SCREEN_WIDTH;
+            const uint8_t* prev = shadow + p * SCREEN_WIDTH;
+            
+            int first = 0;
+            int last = SCREEN_WIDTH - 1;
+            if (shadowValid) {
+                while (first < SCREEN_WIDTH && row[first] == prev[first]) first++;
+                if (first == SCREEN_WIDTH) continue;
+                while (row[last] == prev[last]) last--;
+            }
+            
+            if (first < col0) col0 = first;
+            if (last > col1) col1 = last;
+            if (p < page0) page0 = p;
+            page1 = p;
+        }
+        
+        if (page1 < 0) return true; // Nothing changed
+        #else
+        int col0 = 0, col1 = SCREEN_WIDTH - 1;
+        int page0 = 0, page1 = pages - 1;
+        #endif
+        
+        if (!transport->acquireBus()) return false;
+        
+        transport->setWindow(col0, col1, page0, page1);
+        int spanWidth = col1 - col0 + 1;
+        for (int p = page0; p <= page1; p++) {
+            transport->writeData(buffer + p * SCREEN_WIDTH + col0, spanWidth);
+        }
+        if (!transport->releaseBus()) {
+            // Panel contents are unknown now; resend everything next time
+            invalidate();
+            return false;
+        }
+        
+        #if MINTUI_PARTIAL_FLUSH
+        for (int p = page0; p <= page1; p++) {
+            memcpy(shadow + p * SCREEN_WIDTH + col0,
+                   buffer + p * SCREEN_WIDTH + col0, spanWidth);
+        }
+        #endif
+        shadowValid = true;
         return true;
     }
     
@@ -614,7 +1061,7 @@ public:
             // Ownership remains with the creator/global scope.
         }
         
-        display.display();
+        flush();
     }
     
 private:
@@ -0,0 +1,4 @@
+// Adafruit_GFX is only needed through Adafruit_SSD1306.h on the host
+#ifndef MINTUI_SHIM_ADAFRUIT_GFX_H
+#define MINTUI_SHIM_ADAFRUIT_GFX_H
+#endif
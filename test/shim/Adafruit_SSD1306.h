@@ -0,0 +1,57 @@
+// Frame buffer only SSD1306 stand-in: drawing touches the buffer, begin()
+// and display() never reach the bus
+#ifndef MINTUI_SHIM_ADAFRUIT_SSD1306_H
+#define MINTUI_SHIM_ADAFRUIT_SSD1306_H
+
+#include "Arduino.h"
+#include "Wire.h"
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+#define SSD1306_SETCONTRAST 0x81
+
+class Adafruit_SSD1306 {
+private:
+    int16_t w, h;
+    uint8_t buffer[128 * 64 / 8];
+
+public:
+    Adafruit_SSD1306(int16_t w, int16_t h, TwoWire*, int8_t) : w(w), h(h) {
+        clearDisplay();
+    }
+
+    bool begin(uint8_t, uint8_t) { return true; }
+    void display() {}
+    void clearDisplay() { memset(buffer, 0, sizeof(buffer)); }
+    uint8_t* getBuffer() { return buffer; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+        if (x < 0 || x >= w || y < 0 || y >= h) return;
+        uint8_t& b = buffer[(y / 8) * w + x];
+        if (color) b |= (1 << (y & 7));
+        else b &= ~(1 << (y & 7));
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t rw, int16_t rh, uint16_t color) {
+        for (int16_t j = y; j < y + rh; j++)
+            for (int16_t i = x; i < x + rw; i++) drawPixel(i, j, color);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t rw, int16_t rh, uint16_t color) {
+        fillRect(x, y, rw, 1, color);
+        fillRect(x, y + rh - 1, rw, 1, color);
+        fillRect(x, y, 1, rh, color);
+        fillRect(x + rw - 1, y, 1, rh, color);
+    }
+
+    // Text is not rasterized on the host
+    void setTextSize(uint8_t) {}
+    void setTextColor(uint16_t) {}
+    void setCursor(int16_t, int16_t) {}
+    void print(const String&) {}
+};
+
+#endif
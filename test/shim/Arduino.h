@@ -0,0 +1,28 @@
+// Minimal Arduino core for building MintUi.h on the host
+#ifndef MINTUI_SHIM_ARDUINO_H
+#define MINTUI_SHIM_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+
+#define INPUT 0x0
+#define INPUT_PULLUP 0x2
+#define LOW 0x0
+#define HIGH 0x1
+
+// Advanced by the test to drive animations
+extern unsigned long shimMillis;
+
+inline unsigned long millis() { return shimMillis; }
+inline void pinMode(int, int) {}
+inline int digitalRead(int) { return HIGH; }
+
+class String : public std::string {
+public:
+    String(const char* s = "") : std::string(s) {}
+    String(const std::string& s) : std::string(s) {}
+};
+
+#endif
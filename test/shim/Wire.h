@@ -0,0 +1,28 @@
+// Wire stub that records the clock each transaction ran at
+#ifndef MINTUI_SHIM_WIRE_H
+#define MINTUI_SHIM_WIRE_H
+
+#include "Arduino.h"
+
+class TwoWire {
+public:
+    uint32_t clock;
+    uint32_t transactionClock;
+    unsigned long transactions;
+
+    TwoWire() : clock(100000), transactionClock(0), transactions(0) {}
+
+    void begin() {}
+    void setClock(uint32_t hz) { clock = hz; }
+    void beginTransmission(uint8_t) {
+        transactionClock = clock;
+        transactions++;
+    }
+    size_t write(uint8_t) { return 1; }
+    size_t write(const uint8_t*, size_t len) { return len; }
+    uint8_t endTransmission() { return 0; }
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,189 @@
+// Host check for the display transport: builds MintUi.h against the shims
+// in test/shim and verifies what RecordingTransport sees on the "bus".
+//
+//   make -C test
+
+#include <stdio.h>
+#include "MintUi.h"
+
+TwoWire Wire;
+unsigned long shimMillis = 0;
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+static const int FRAME_BYTES = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+
+static bool ramMatches(RecordingTransport& rec, UIEngine& ui) {
+    return memcmp(rec.getRam(), ui.getDisplay().getBuffer(), FRAME_BYTES) == 0;
+}
+
+// Run update() until the window transitions have finished
+static void settle(UIEngine& ui) {
+    for (int i = 0; i < 100; i++) {
+        shimMillis += 10;
+        ui.update();
+    }
+}
+
+static bool arbiterFree = true;
+static int releases = 0;
+static bool acquireBus() { return arbiterFree; }
+static void releaseBus() { releases++; }
+
+static void testFullFrame() {
+    RecordingTransport rec(32);
+    UIEngine ui;
+    ui.setTransport(&rec);
+    CHECK(ui.begin());
+
+    // 1024 data bytes in 31-byte chunks plus one 6-byte window command
+    CHECK(rec.getTransactions() == 35);
+    CHECK(rec.getCommandBytes() == 6);
+    CHECK(rec.getDataBytes() == FRAME_BYTES);
+    CHECK(rec.getBusBytes() == 1100);
+}
+
+static void testPartialFlush() {
+    RecordingTransport rec(32);
+    UIEngine ui;
+    ui.setTransport(&rec);
+    ui.begin();
+
+    Window window("Main");
+    window.addWidget(new Button(10, 20, 40, 12, "OK"));
+    ui.pushWindow(&window);
+    settle(ui);
+    CHECK(ramMatches(rec, ui));
+
+    // Unchanged frame: nothing on the bus
+    rec.reset();
+    CHECK(ui.flush());
+    CHECK(rec.getTransactions() == 0);
+
+    // One pixel: window command + one data byte
+    rec.reset();
+    ui.getDisplay().drawPixel(100, 40, SSD1306_WHITE);
+    CHECK(ui.flush());
+    CHECK(rec.getTransactions() == 2);
+    CHECK(rec.getBusBytes() == 11);
+    CHECK(ramMatches(rec, ui));
+
+    // update() redraws without the pixel, clearing it on the panel...
+    rec.reset();
+    shimMillis += 10;
+    ui.update();
+    CHECK(rec.getTransactions() == 2);
+    CHECK(ramMatches(rec, ui));
+
+    // ...after which identical frames send nothing
+    rec.reset();
+    shimMillis += 10;
+    ui.update();
+    CHECK(rec.getTransactions() == 0);
+}
+
+static void testFailedWriteInvalidates() {
+    RecordingTransport rec(32);
+    UIEngine ui;
+    ui.setTransport(&rec);
+    ui.begin();
+
+    rec.injectFailures(1);
+    ui.getDisplay().drawPixel(0, 0, SSD1306_WHITE);
+    CHECK(!ui.flush());
+
+    // Next flush resends the whole frame even without further changes
+    rec.reset();
+    CHECK(ui.flush());
+    CHECK(rec.getDataBytes() == FRAME_BYTES);
+    CHECK(ramMatches(rec, ui));
+}
+
+static void testArbiter() {
+    RecordingTransport rec(32);
+    UIEngine ui;
+    ui.setBusArbiter(acquireBus, releaseBus);
+    ui.setTransport(&rec); // Arbiter follows the transport
+    ui.begin();
+
+    arbiterFree = false;
+    rec.reset();
+    ui.getDisplay().drawPixel(5, 40, SSD1306_WHITE);
+    CHECK(!ui.flush());
+    CHECK(rec.getTransactions() == 0);
+
+    arbiterFree = true;
+    releases = 0;
+    CHECK(ui.flush());
+    CHECK(releases == 1);
+    CHECK(rec.getDataBytes() == 1);
+    CHECK(ramMatches(rec, ui));
+}
+
+static void testClockRestore() {
+    UIEngine ui;
+    ui.begin();
+    CHECK(Wire.transactionClock == MINTUI_I2C_FAST);
+    CHECK(Wire.clock == MINTUI_I2C_STANDARD);
+
+    ui.setBusClock(MINTUI_I2C_FAST_PLUS, 0);
+    ui.invalidate();
+    ui.flush();
+    CHECK(Wire.transactionClock == MINTUI_I2C_FAST_PLUS);
+    CHECK(Wire.clock == MINTUI_I2C_FAST_PLUS);
+}
+
+static void testCommandArguments() {
+    RecordingTransport rec(32);
+
+    // 0x22 here is the contrast value, not PAGEADDR
+    const uint8_t cmds[] = { SSD1306_SETCONTRAST, 0x22 };
+    rec.writeCommands(cmds, sizeof(cmds));
+
+    uint8_t data[FRAME_BYTES];
+    for (int i = 0; i < FRAME_BYTES; i++) data[i] = (uint8_t)(i * 7);
+    rec.setWindow(0, SCREEN_WIDTH - 1, 0, SCREEN_HEIGHT / 8 - 1);
+    rec.writeData(data, sizeof(data));
+    CHECK(rec.releaseBus());
+    CHECK(memcmp(rec.getRam(), data, FRAME_BYTES) == 0);
+}
+
+// Bus time for a full frame: 9 clocks per byte plus start/stop
+static void reportFullFrameTime(size_t maxTransfer) {
+    RecordingTransport rec(maxTransfer);
+    UIEngine ui;
+    ui.setTransport(&rec);
+    ui.begin();
+
+    unsigned long clocks = rec.getBusBytes() * 9 + rec.getTransactions() * 2;
+    printf("full frame, %3u-byte transfers: %2lu transactions, %4lu bytes, "
+           "%.1fms @400kHz, %.1fms @1MHz\n",
+           (unsigned)maxTransfer, rec.getTransactions(), rec.getBusBytes(),
+           clocks / 400.0, clocks / 1000.0);
+}
+
+int main() {
+    testFullFrame();
+    testPartialFlush();
+    testFailedWriteInvalidates();
+    testArbiter();
+    testClockRestore();
+    testCommandArguments();
+
+    reportFullFrameTime(32);
+    reportFullFrameTime(128);
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all transport checks passed\n");
+    return 0;
+}